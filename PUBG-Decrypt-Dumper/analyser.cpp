@@ -81,12 +81,14 @@ std::optional<size_t> Analyser::get_last_modified(const InstructionTrace& instru
 
 bool Analyser::init()
 {
-	if (std::holds_alternative<ZydisRegister>(result))
-		printf("Analyzing %s\n", ZydisRegisterGetString(std::get<ZydisRegister>(result)));
-	else {
-		auto [base, disp, size] = std::get<std::tuple<ZydisRegister, uint64_t, uint8_t>>(result);
-		std::string str = "Analyzing [" + std::string(ZydisRegisterGetString(base)) + " + " + std::to_string(disp) + "]" + " (" + std::to_string(size) + " bytes)";
-		printf("%s\n", str.c_str());
+	if (trace) {
+		if (std::holds_alternative<ZydisRegister>(result))
+			printf("Analyzing %s\n", ZydisRegisterGetString(std::get<ZydisRegister>(result)));
+		else {
+			auto [base, disp, size] = std::get<std::tuple<ZydisRegister, uint64_t, uint8_t>>(result);
+			std::string str = "Analyzing [" + std::string(ZydisRegisterGetString(base)) + " + " + std::to_string(disp) + "]" + " (" + std::to_string(size) + " bytes)";
+			printf("%s\n", str.c_str());
+		}
 	}
 
 	uintptr_t current = start;
@@ -129,6 +131,11 @@ bool Analyser::init()
 std::optional<std::pair<std::vector<InstructionTrace>, location>> Analyser::get_result() const {
 	std::vector<InstructionTrace> needed;
 	for (const auto& instruction : instructions) {
+		if (instruction.needed)
+			needed.push_back(instruction);
+
+		if (!trace)
+			continue;
 
 		ZydisFormatter formatter;
 		ZydisFormatterInit(&formatter, ZYDIS_FORMATTER_STYLE_INTEL);
@@ -143,11 +150,9 @@ std::optional<std::pair<std::vector<InstructionTrace>, location>> Analyser::get_
 		else
 			printf("\033[0m");
 		printf("%s\n", buffer);
-
-		if (instruction.needed)
-			needed.push_back(instruction);
 	}
-	printf("\033[0m");
+	if (trace)
+		printf("\033[0m");
 
 	if (unknown_values.size() == 0)
 		return std::nullopt;
@@ -157,13 +162,15 @@ std::optional<std::pair<std::vector<InstructionTrace>, location>> Analyser::get_
 		// make sure unknown instructions contain the same location
 		for (const auto& l : unknown_values) {
 			if (!is_same_location(l, loc)) {
-				printf("Error: unknown values contain different locations\n\n");
+				if (trace)
+					printf("Error: unknown values contain different locations\n\n");
 				return std::nullopt;
 			}
 		}
 	}
 
-	printf("\n");
+	if (trace)
+		printf("\n");
 
 	return std::pair{ needed, loc };
 }
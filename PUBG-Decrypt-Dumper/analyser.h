@@ -55,6 +55,9 @@ public:
 
 	bool init();
 
+	// print the disassembly trace of every analysis (disabled in server mode)
+	static inline bool trace = true;
+
 	std::optional<std::pair<std::vector<InstructionTrace>, location>> get_result() const;
 private:
 	// Needed instructions, Unknown value instructions
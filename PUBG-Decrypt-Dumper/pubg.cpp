@@ -1,5 +1,6 @@
 #include "pubg.h"
 #include "memory.h"
+#include <sstream>
 
 template <typename T>
 std::optional<pubg::Decryptor<T>> get_decryptor(const ZydisDecoder& decoder, uintptr_t start, uintptr_t end, location result) {
@@ -53,13 +54,13 @@ std::optional<pubg::Decryptor<T>> get_decryptor(const ZydisDecoder& decoder, uin
 			decryptor.ror = true;
 			[[fallthrough]];
 		case ZYDIS_MNEMONIC_ROL:
-			if (operand.imm.value.u > std::numeric_limits<uint8_t>::max())
+			if (operand.imm.value.u > std::numeric_limits<uint8_t>::max() && Analyser::trace)
 				printf("ror/rol too big");
 			decryptor.rval = (int8_t)operand.imm.value.u;
 			break;
 		case ZYDIS_MNEMONIC_SHR:
 		case ZYDIS_MNEMONIC_SHL:
-			if (operand.imm.value.u > std::numeric_limits<uint8_t>::max())
+			if (operand.imm.value.u > std::numeric_limits<uint8_t>::max() && Analyser::trace)
 				printf("shr/shl too big");
 			decryptor.sval = (int8_t)operand.imm.value.u;
 			break;
@@ -181,3 +182,22 @@ std::optional<pubg::decryptor_list> pubg::get_decryptors(const ZydisDecoder& dec
 		return std::nullopt;
 	}
 }
+
+std::string pubg::format_decryptors(const pubg::decryptor_list& decryptors) {
+	std::ostringstream out;
+	out << "Found decryptors:" << std::endl;
+
+	auto& [fname_index, fname_number, object_index, object_class, object_outer] = decryptors;
+
+	if (fname_index->is_valid())
+		out << "FName index:\n" << std::string(*fname_index) << "\n";
+	if (fname_number->is_valid())
+		out << "FName number:\n" << std::string(*fname_number) << "\n";
+	if (object_index->is_valid())
+		out << "Object index:\n" << std::string(*object_index) << "\n";
+	if (object_class->is_valid())
+		out << "Object class:\n" << std::string(*object_class) << "\n";
+	if (object_outer->is_valid())
+		out << "Object outer:\n" << std::string(*object_outer) << "\n";
+	return out.str();
+}
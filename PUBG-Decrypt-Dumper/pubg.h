@@ -76,4 +76,5 @@ namespace pubg
 
 	using decryptor_list = std::tuple<std::unique_ptr<Decryptor32>, std::unique_ptr<Decryptor32>, std::unique_ptr<Decryptor32>, std::unique_ptr<Decryptor64>, std::unique_ptr<Decryptor64>>;
 	std::optional<decryptor_list> get_decryptors(const ZydisDecoder& decoder, const uintptr_t start, const uintptr_t end);
+	std::string format_decryptors(const decryptor_list& decryptors);
 }
\ No newline at end of file
@@ -0,0 +1,334 @@
+#include <winsock2.h>
+#include <afunix.h>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "server.h"
+#include "pubg.h"
+#pragma comment(lib, "Ws2_32.lib")
+
+struct Image {
+	std::mutex mutex;
+	std::filesystem::file_time_type write_time;
+
+	bool analysed = false;
+	bool found = false;
+	std::string result;
+};
+
+struct Response {
+	bool ok;
+	std::string body;
+};
+
+std::mutex images_mutex;
+std::map<std::filesystem::path, std::shared_ptr<Image>> images;
+
+std::atomic<uint64_t> cache_hits;
+std::atomic<uint64_t> cache_misses;
+
+// longest command plus a path, longer lines drop the connection
+constexpr size_t max_line_length = MAX_PATH + 0x10;
+
+bool read_line(SOCKET socket, std::string& buffer, std::string& line) {
+	size_t pos;
+	while ((pos = buffer.find('\n')) == std::string::npos) {
+		if (buffer.size() > max_line_length)
+			return false;
+
+		char chunk[0x100];
+		int received = recv(socket, chunk, sizeof(chunk), 0);
+		if (received <= 0)
+			return false;
+		buffer.append(chunk, received);
+	}
+	line = buffer.substr(0, pos);
+	buffer.erase(0, pos + 1);
+	return true;
+}
+
+bool send_all(SOCKET socket, const std::string& data) {
+	size_t sent = 0;
+	while (sent < data.size()) {
+		int count = send(socket, data.data() + sent, (int)(data.size() - sent), 0);
+		if (count == SOCKET_ERROR)
+			return false;
+		sent += count;
+	}
+	return true;
+}
+
+// pairs WSAStartup with WSACleanup on every exit path
+struct Winsock {
+	bool ok;
+	Winsock() {
+		WSADATA wsa_data;
+		ok = WSAStartup(MAKEWORD(2, 2), &wsa_data) == 0;
+		if (!ok)
+			std::cout << "Failed to initialize winsock" << std::endl;
+	}
+	~Winsock() {
+		if (ok)
+			WSACleanup();
+	}
+	Winsock(const Winsock&) = delete;
+	Winsock& operator=(const Winsock&) = delete;
+};
+
+bool open_socket(const char* socket_path, SOCKET& socket_out, sockaddr_un& address) {
+	if (strnlen_s(socket_path, sizeof(address.sun_path)) >= sizeof(address.sun_path)) {
+		std::cout << "Socket path too long: " << socket_path << std::endl;
+		return false;
+	}
+
+	socket_out = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (socket_out == INVALID_SOCKET) {
+		std::cout << "Failed to create socket: " << WSAGetLastError() << std::endl;
+		return false;
+	}
+
+	address = {};
+	address.sun_family = AF_UNIX;
+	strncpy_s(address.sun_path, socket_path, sizeof(address.sun_path) - 1);
+	return true;
+}
+
+bool remove_stale_socket(const char* socket_path, const sockaddr_un& address) {
+	DWORD attributes = GetFileAttributesA(socket_path);
+	if (attributes == INVALID_FILE_ATTRIBUTES)
+		return true; // nothing to remove
+
+	WIN32_FIND_DATAA find_data;
+	HANDLE find = FindFirstFileA(socket_path, &find_data);
+	if (find != INVALID_HANDLE_VALUE)
+		FindClose(find);
+	// reparse tag is only valid for reparse points
+	if (!(attributes & FILE_ATTRIBUTE_REPARSE_POINT) || find == INVALID_HANDLE_VALUE || find_data.dwReserved0 != IO_REPARSE_TAG_AF_UNIX) {
+		std::cout << "Refusing to replace " << socket_path << ": not a socket" << std::endl;
+		return false;
+	}
+
+	SOCKET probe = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (probe == INVALID_SOCKET) {
+		std::cout << "Failed to create socket: " << WSAGetLastError() << std::endl;
+		return false;
+	}
+	bool running = connect(probe, (sockaddr*)&address, sizeof(address)) != SOCKET_ERROR;
+	closesocket(probe);
+	if (running) {
+		std::cout << "A server is already listening on " << socket_path << std::endl;
+		return false;
+	}
+
+	if (!DeleteFileA(socket_path)) { // stale socket from a previous run
+		std::cout << "Failed to remove stale socket " << socket_path << ": " << GetLastError() << std::endl;
+		return false;
+	}
+	return true;
+}
+
+void forget_image(const std::filesystem::path& path, const std::shared_ptr<Image>& image) {
+	std::lock_guard lock(images_mutex);
+	auto it = images.find(path);
+	if (it != images.end() && it->second == image)
+		images.erase(it);
+}
+
+Response scan(const ZydisDecoder& decoder, const std::filesystem::path& path) {
+	// missing files never get a cache entry
+	std::error_code error;
+	auto write_time = std::filesystem::last_write_time(path, error);
+	if (error)
+		return { false, "Failed to open file: " + path.string() + "\n" };
+
+	std::shared_ptr<Image> image;
+	{
+		std::lock_guard lock(images_mutex);
+		auto& entry = images[path];
+		if (!entry)
+			entry = std::make_shared<Image>();
+		image = entry;
+	}
+
+	// requests for different images run concurrently, the same image is only analysed once
+	std::lock_guard lock(image->mutex);
+
+	if (image->analysed && image->write_time == write_time) {
+		cache_hits++;
+		return { image->found, image->result };
+	}
+	cache_misses++;
+
+	// only the result is cached, the dump itself is released once analysed
+	image->analysed = false;
+	std::vector<uint8_t> data = open_binary_file(path);
+	image->write_time = write_time;
+	if (data.empty()) {
+		forget_image(path, image);
+		return { false, "Failed to open file: " + path.string() + "\n" };
+	}
+
+	std::optional<pubg::decryptor_list> result;
+	try {
+		result = pubg::get_decryptors(decoder, (uintptr_t)data.data(), (uintptr_t)data.data() + data.size());
+	}
+	catch (...) {
+		forget_image(path, image);
+		throw;
+	}
+
+	image->analysed = true;
+	image->found = result.has_value();
+	image->result = image->found ? pubg::format_decryptors(result.value()) : "Failed to find decryptors\n";
+	return { image->found, image->result };
+}
+
+Response drop(const std::filesystem::path& path) {
+	std::lock_guard lock(images_mutex);
+	if (!images.erase(path))
+		return { false, "Not cached: " + path.string() + "\n" };
+	return { true, "Dropped: " + path.string() + "\n" };
+}
+
+Response stats() {
+	size_t count;
+	{
+		std::lock_guard lock(images_mutex);
+		count = images.size();
+	}
+	return { true, "Images: " + std::to_string(count) + "\nHits: " + std::to_string(cache_hits) + "\nMisses: " + std::to_string(cache_misses) + "\n" };
+}
+
+Response handle_request(const ZydisDecoder& decoder, const std::string& request) {
+	size_t separator = request.find(' ');
+	std::string command = request.substr(0, separator);
+	std::string argument = separator == std::string::npos ? "" : request.substr(separator + 1);
+
+	try {
+		if (command == "scan" && !argument.empty())
+			return scan(decoder, std::filesystem::absolute(argument));
+		if (command == "drop" && !argument.empty())
+			return drop(std::filesystem::absolute(argument));
+		if (command == "stats")
+			return stats();
+	}
+	catch (const std::exception& e) {
+		return { false, std::string(e.what()) + "\n" };
+	}
+	return { false, "Unknown request: " + request + "\n" };
+}
+
+void handle_client(const ZydisDecoder& decoder, SOCKET client) {
+	std::string buffer;
+	std::string request;
+	while (read_line(client, buffer, request)) {
+		if (!request.empty() && request.back() == '\r')
+			request.pop_back();
+
+		auto begin = std::chrono::steady_clock::now();
+		Response response = handle_request(decoder, request);
+		auto latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+
+		printf("%s -> %s (%lld us)\n", request.c_str(), response.ok ? "ok" : "err", (long long)latency);
+
+		std::string header = std::string(response.ok ? "ok " : "err ") + std::to_string(latency) + " " + std::to_string(response.body.size()) + "\n";
+		if (!send_all(client, header + response.body))
+			break;
+	}
+	closesocket(client);
+}
+
+int server::run(const ZydisDecoder& decoder, const char* socket_path) {
+	Winsock winsock;
+	if (!winsock.ok)
+		return 1;
+
+	SOCKET listener;
+	sockaddr_un address;
+	if (!open_socket(socket_path, listener, address))
+		return 1;
+
+	if (!remove_stale_socket(socket_path, address)) {
+		closesocket(listener);
+		return 1;
+	}
+
+	if (bind(listener, (sockaddr*)&address, sizeof(address)) == SOCKET_ERROR
+		|| listen(listener, SOMAXCONN) == SOCKET_ERROR) {
+		std::cout << "Failed to listen on " << socket_path << ": " << WSAGetLastError() << std::endl;
+		closesocket(listener);
+		return 1;
+	}
+
+	// concurrent analyses would interleave their traces with the request log
+	Analyser::trace = false;
+	std::cout << "Listening on " << socket_path << std::endl;
+
+	while (true) {
+		SOCKET client = accept(listener, nullptr, nullptr);
+		if (client == INVALID_SOCKET) {
+			std::cout << "Failed to accept connection: " << WSAGetLastError() << std::endl;
+			break;
+		}
+		std::thread(handle_client, std::cref(decoder), client).detach();
+	}
+
+	closesocket(listener);
+	return 1;
+}
+
+int server::query(const char* socket_path, const std::string& request) {
+	Winsock winsock;
+	if (!winsock.ok)
+		return 1;
+
+	SOCKET connection;
+	sockaddr_un address;
+	if (!open_socket(socket_path, connection, address))
+		return 1;
+
+	if (connect(connection, (sockaddr*)&address, sizeof(address)) == SOCKET_ERROR) {
+		std::cout << "Failed to connect to " << socket_path << ": " << WSAGetLastError() << std::endl;
+		closesocket(connection);
+		return 1;
+	}
+
+	std::string buffer;
+	std::string header;
+	if (!send_all(connection, request + "\n") || !read_line(connection, buffer, header)) {
+		std::cout << "Failed to send request" << std::endl;
+		closesocket(connection);
+		return 1;
+	}
+
+	char status[8] = {};
+	long long latency = 0;
+	size_t size = 0;
+	if (sscanf_s(header.c_str(), "%7s %lld %zu", status, (unsigned)sizeof(status), &latency, &size) != 3) {
+		std::cout << "Malformed response: " << header << std::endl;
+		closesocket(connection);
+		return 1;
+	}
+
+	while (buffer.size() < size) {
+		char chunk[0x1000];
+		int received = recv(connection, chunk, sizeof(chunk), 0);
+		if (received <= 0)
+			break;
+		buffer.append(chunk, received);
+	}
+	closesocket(connection);
+
+	if (buffer.size() < size) {
+		std::cout << "Connection closed after " << buffer.size() << " of " << size << " bytes" << std::endl;
+		return 1;
+	}
+
+	std::cout << buffer.substr(0, size) << "(" << latency << " us)" << std::endl;
+	return strcmp(status, "ok") == 0 ? 0 : 1;
+}
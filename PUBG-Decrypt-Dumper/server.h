@@ -0,0 +1,31 @@
+#pragma once
+#include <string>
+#define ZYDIS_STATIC_BUILD
+#include <Zydis/Zydis.h>
+#pragma comment(lib, "Zydis.lib")
+
+// Request: "<command> [argument]\n"
+//   scan <path>  analyse the image at <path> (cached until the file changes)
+//   drop <path>  evict the image at <path> from the cache
+//   stats        cache size and hit/miss counters
+// Response: "<ok|err> <latency in us> <body size>\n<body>"
+namespace server
+{
+	/**
+	* @brief Serve requests on a local unix domain socket, one thread per connection
+	*
+	* @param decoder The decoder shared by all requests
+	* @param socket_path The path of the socket to create
+	*
+	*/
+	int run(const ZydisDecoder& decoder, const char* socket_path);
+
+	/**
+	* @brief Send a single request to a running server and print the response
+	*
+	* @param socket_path The path of the server socket
+	* @param request The request line (without the trailing newline)
+	*
+	*/
+	int query(const char* socket_path, const std::string& request);
+}
@@ -2,6 +2,8 @@
 #include <winternl.h>
 #include "memory.h"
 #include "utils.h"
+#include <iostream>
+#include <fstream>
 
 bool Compare(const uint8_t* data, const uint8_t* sig, const char* pat, uint32_t size) {
 	for (uint32_t i = 0; i < size; i++) {
@@ -83,4 +85,20 @@ uintptr_t find_instruction_mnemonic(const ZydisDecoder& decoder, const uintptr_t
 	return find_instuction(decoder, start, end, [&](const ZydisDecodedInstruction& instruction)->bool {
 		return instruction.mnemonic == mnemonic;
 		});
+}
+
+std::vector<uint8_t> open_binary_file(std::filesystem::path path) {
+	std::ifstream file(path, std::ios::binary);
+	if (!file.is_open()) {
+		std::cout << "Failed to open file: " << path << std::endl;
+		return {};
+	}
+
+	file.seekg(0, std::ios::end);
+	size_t size = file.tellg();
+	file.seekg(0, std::ios::beg);
+
+	std::vector<uint8_t> data(size);
+	file.read((char*)data.data(), size);
+	return data;
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 #include <functional>
+#include <filesystem>
+#include <vector>
 #define ZYDIS_STATIC_BUILD
 #include <Zydis/Zydis.h>
 #pragma comment(lib, "Zydis.lib")
@@ -10,4 +12,6 @@ uint8_t* FindSignature(void* start, void* end, const char* ida_sig);
 
 uint64_t find_instruction_category(const ZydisDecoder& decoder, const uintptr_t start, const uintptr_t end, const ZydisInstructionCategory category);
 
-uint64_t find_instruction_mnemonic(const ZydisDecoder& decoder, const uintptr_t start, const uintptr_t end, const ZydisMnemonic mnemonic);
\ No newline at end of file
+uint64_t find_instruction_mnemonic(const ZydisDecoder& decoder, const uintptr_t start, const uintptr_t end, const ZydisMnemonic mnemonic);
+
+std::vector<uint8_t> open_binary_file(std::filesystem::path path);
\ No newline at end of file